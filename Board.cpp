@@ -12,6 +12,9 @@ como uma matriz de variaveis do enum BoardState
 
 OBS: Posição dos elementos é indexada por I (Linha) e J (Coluna) igual numa matriz normal.
 
+Além dos elementos, guarda um índice de ocupação (matriz de IDs de entidade), para saber qual bandido/policial está em cada célula. O índice e a matriz
+de elementos são sempre atualizados juntos (place_entity e move_entity).
+
 Tem funções para mudar o estado do tabuleiro (set_position) e outras para apenas ler o estado (verificar se a posição é valida, oq tem nela...)
 
 Também implementa uma função que escolhe randomicamente entre 3 mapas e gera o tabuleiro de acordo com o mapa escolhido (Cruz ou X).
@@ -35,6 +38,7 @@ class Board { //classe que lida com as posições do tabuleiro, os mutexes dela
 
    private:
       vector<vector<BoardState>> cells; //vetor de células do mapa
+      vector<vector<int>> occupants; //ID da entidade (bandido/policial) em cada célula, NO_ENTITY se não tiver
       int size;
       mt19937 generator;  //atributos para gerar números aleatórios
       uniform_int_distribution<> map_type_distrib; //gerar o tipo do mapa
@@ -96,12 +100,15 @@ class Board { //classe que lida com as posições do tabuleiro, os mutexes dela
 
    public:
 
+   static constexpr int NO_ENTITY = -1; //ID usado nas células sem bandido ou policial
+
    vector<vector<mutex>> mutexes; //mutex para cada célula do mapa, vai ser público porque deve ser acessados por diversas threads
    //em um escopo amplo
 
    Board(const int size) //construtor da classe
         : size(size), 
           cells(size, vector<BoardState>(size, BoardState::EMPTY)), 
+          occupants(size, vector<int>(size, NO_ENTITY)),
           generator(static_cast<unsigned int>(chrono::system_clock::now().time_since_epoch().count())),                             
           map_type_distrib(1, 2)                  
     {
@@ -195,6 +202,31 @@ class Board { //classe que lida com as posições do tabuleiro, os mutexes dela
       return true;
    }
 
+   int get_occupant(const int i, const int j){ //retorna o ID da entidade na posição i,j (NO_ENTITY se não tiver)
+         if (!this->position_is_valid(i,j))
+            return NO_ENTITY;
+         return this->occupants[i][j];
+   }
+
+   bool place_entity(const int i, const int j, const BoardState state, const int entity_id){ //coloca uma entidade (bandido/policial) e seu ID na posição
+      if (!this->position_is_valid(i,j))
+         return false;
+      cells[i][j] = state;
+      occupants[i][j] = entity_id;
+      return true;
+   }
+
+   bool move_entity(const int old_i, const int old_j, const int new_i, const int new_j){ //move o elemento e o ID da posição antiga para a nova,
+      //sobrescrevendo o que tinha no destino (ex: dinheiro) e deixando a posição antiga vazia
+      if (!this->position_is_valid(old_i,old_j) || !this->position_is_valid(new_i,new_j))
+         return false;
+      cells[new_i][new_j] = cells[old_i][old_j];
+      occupants[new_i][new_j] = occupants[old_i][old_j];
+      cells[old_i][old_j] = BoardState::EMPTY;
+      occupants[old_i][old_j] = NO_ENTITY;
+      return true;
+   }
+
    void draw_victory(){ //printa tela de vitória
     std::string green = "\033[32m"; //  cor verde
     std::string reset = "\033[0m";   // Reset color
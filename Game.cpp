@@ -13,6 +13,7 @@
 #include <cctype> 
 #include <unistd.h>
 #include <termios.h>
+#include <functional>
 
 using namespace std;
 
@@ -24,7 +25,10 @@ tem atributos também para guardar a posição do bandido, dos policiais e o din
 Ela tem métodos para gerar os elementos (Bandido, policial e dinheiro) do jogo e colocar eles no tabuleiro, para renderizar a tela de forma infinita 
 (até ter game-over ou vitória).
 
-Além disso, o input do jogador e a lógica de movimento do bandido estão implementadas nessa classe (métodos move_robber e robber_logic).
+Além disso, o input do jogador e a lógica de movimento do bandido estão implementadas nessa classe.
+
+Todo movimento (do bandido ou de um policial) passa pelo método commit_move, que atualiza o tabuleiro e o índice de ocupação e, no mesmo passo,
+resolve captura, coleta de dinheiro e vitória. Esses resultados são publicados como eventos (GameEvent) para os inscritos (método subscribe).
 */
 
 class Game {
@@ -45,6 +49,21 @@ class Game {
             INVALID
         };
 
+    public:
+        // Eventos publicados quando um movimento é aplicado no tabuleiro
+        enum class GameEvent {
+            MONEY_COLLECTED,
+            ROBBER_CAPTURED,
+            ROBBER_WON
+        };
+
+        using EventHandler = function<void(GameEvent, const pair<int,int>&)>;
+
+    private:
+        // IDs das entidades no índice de ocupação do tabuleiro (policial i tem ID FIRST_COP_ID + i)
+        static constexpr int ROBBER_ID = 0;
+        static constexpr int FIRST_COP_ID = 1;
+
         // Atrasos em segundos para ações de thread
         const int REFRESH_BOARD_DELAY = 100;
         const int USER_INPUT_DELAY = 100;
@@ -69,6 +88,9 @@ class Game {
         thread render_thread;
         thread input_thread;
 
+        // Inscritos nos eventos do jogo
+        vector<EventHandler> event_subscribers;
+
         // Métodos auxiliares para posicionamento aleatório
         int get_random_position() {
             return map_elements_distrib(generator);
@@ -89,7 +111,7 @@ class Game {
                 int new_j = get_random_position();
 
                 if (game_board.position_is_free(new_i, new_j)) {
-                    game_board.set_position(new_i, new_j, BoardState::COP);
+                    game_board.place_entity(new_i, new_j, BoardState::COP, FIRST_COP_ID + cops_generated);
                     cop_positions.emplace_back(new_i, new_j);
                     cops_generated++;
                 }
@@ -124,7 +146,7 @@ class Game {
                 }
             }
 
-            game_board.set_position(robber_i, robber_j, BoardState::ROBBER);
+            game_board.place_entity(robber_i, robber_j, BoardState::ROBBER, ROBBER_ID);
             robber_position = make_pair(robber_i, robber_j);
 
             // Geração de dinheiro
@@ -140,28 +162,77 @@ class Game {
             }
         }
 
-    bool is_adjacent_to_robber(const pair<int, int>& cop_pos) {
-        // Verifica todas as posições adjacentes (incluindo diagonais)
+    bool robber_is_caught() {
+        // Verifica no índice de ocupação se tem algum policial nas posições adjacentes ao ladrão (incluindo diagonais)
         vector<pair<int, int>> adjacent_positions = {
-            {cop_pos.first-1, cop_pos.second},   // cima
-            {cop_pos.first+1, cop_pos.second},   // baixo
-            {cop_pos.first, cop_pos.second-1},   // esquerda
-            {cop_pos.first, cop_pos.second+1},   // direita
-            {cop_pos.first-1, cop_pos.second-1}, // diagonal superior esquerda
-            {cop_pos.first-1, cop_pos.second+1}, // diagonal superior direita
-            {cop_pos.first+1, cop_pos.second-1}, // diagonal inferior esquerda
-            {cop_pos.first+1, cop_pos.second+1}  // diagonal inferior direita
+            {robber_position.first-1, robber_position.second},   // cima
+            {robber_position.first+1, robber_position.second},   // baixo
+            {robber_position.first, robber_position.second-1},   // esquerda
+            {robber_position.first, robber_position.second+1},   // direita
+            {robber_position.first-1, robber_position.second-1}, // diagonal superior esquerda
+            {robber_position.first-1, robber_position.second+1}, // diagonal superior direita
+            {robber_position.first+1, robber_position.second-1}, // diagonal inferior esquerda
+            {robber_position.first+1, robber_position.second+1}  // diagonal inferior direita
         };
 
         for (const auto& pos : adjacent_positions) {
-            if (game_board.position_is_valid(pos.first, pos.second) && 
-                pos == robber_position) {
+            if (game_board.get_occupant(pos.first, pos.second) >= FIRST_COP_ID) {
                 return true;
             }
         }
         return false;
     }
 
+    void publish_event(GameEvent event, const pair<int, int>& position) {
+        for (const auto& handler : event_subscribers) {
+            handler(event, position);
+        }
+    }
+
+    // Aplica o movimento de uma entidade no tabuleiro e resolve captura, dinheiro e vitória no mesmo passo.
+    // Deve ser chamado com game_mutex travado.
+    void commit_move(const int entity_id, const pair<int, int>& new_pos) {
+        pair<int, int>& old_pos = (entity_id == ROBBER_ID) ? robber_position : cop_positions[entity_id - FIRST_COP_ID];
+        BoardState target = game_board.get_position(new_pos.first, new_pos.second);
+
+        // Bandido e policial tentando ocupar a mesma célula é captura
+        if ((entity_id == ROBBER_ID && target == BoardState::COP) ||
+            (entity_id != ROBBER_ID && target == BoardState::ROBBER)) {
+            publish_event(GameEvent::ROBBER_CAPTURED, robber_position);
+            return;
+        }
+
+        bool collected_money = (entity_id == ROBBER_ID && target == BoardState::MONEY);
+
+        game_board.move_entity(old_pos.first, old_pos.second, new_pos.first, new_pos.second);
+        old_pos = new_pos;
+
+        if (collected_money) {
+            money_num--;
+            publish_event(GameEvent::MONEY_COLLECTED, new_pos);
+        }
+
+        if (money_num == 0) {
+            publish_event(GameEvent::ROBBER_WON, robber_position);
+        } else if (robber_is_caught()) {
+            publish_event(GameEvent::ROBBER_CAPTURED, robber_position);
+        }
+    }
+
+    void handle_game_event(GameEvent event, const pair<int, int>& position) {
+        switch (event) {
+            case GameEvent::MONEY_COLLECTED:
+                cout << "Pegou Dinheiro" << endl;
+                break;
+            case GameEvent::ROBBER_CAPTURED:
+                game_over();
+                break;
+            case GameEvent::ROBBER_WON:
+                game_win();
+                break;
+        }
+    }
+
     void move_cop(int cop_index) {
         while (game_running) {
             {
@@ -170,13 +241,7 @@ class Game {
 
                 if (!game_running) break;
 
-                pair<int, int>& cop_pos = cop_positions[cop_index];
-                
-                // Verifica se o ladrão está adjacente
-                if (is_adjacent_to_robber(cop_pos)) {
-                    game_over();
-                    break;
-                }
+                pair<int, int> cop_pos = cop_positions[cop_index];
 
                 // Calcula a distância até o ladrão
                 int distance_to_robber = abs(cop_pos.first - robber_position.first) + 
@@ -213,16 +278,7 @@ class Game {
 
                     // Move para a melhor posição se encontrou um movimento válido
                     if (best_move != cop_pos) {
-                        // Remove o policial da posição atual
-                        game_board.set_position(cop_pos.first, cop_pos.second, 
-                            game_board.get_position(cop_pos.first, cop_pos.second) == BoardState::COP 
-                            ? BoardState::EMPTY 
-                            : game_board.get_position(cop_pos.first, cop_pos.second)
-                        );
-
-                        // Move o policial para a nova posição
-                        game_board.set_position(best_move.first, best_move.second, BoardState::COP);
-                        cop_pos = best_move;
+                        commit_move(FIRST_COP_ID + cop_index, best_move);
                     }
                 } else {
                     // Movimento aleatório
@@ -245,18 +301,7 @@ class Game {
 
                     if (!valid_moves.empty()) {
                         int move_index = get_random_position() % valid_moves.size();
-                        pair<int, int> new_pos = valid_moves[move_index];
-
-                        // Remove o policial da posição atual
-                        game_board.set_position(cop_pos.first, cop_pos.second, 
-                            game_board.get_position(cop_pos.first, cop_pos.second) == BoardState::COP 
-                            ? BoardState::EMPTY 
-                            : game_board.get_position(cop_pos.first, cop_pos.second)
-                        );
-
-                        // Move o policial para a nova posição
-                        game_board.set_position(new_pos.first, new_pos.second, BoardState::COP);
-                        cop_pos = new_pos;
+                        commit_move(FIRST_COP_ID + cop_index, valid_moves[move_index]);
                     }
                 }
             }
@@ -330,7 +375,7 @@ class Game {
 
                 // Valida o movimento
                 if (game_board.position_is_valid(new_i, new_j) && !game_board.position_has(new_i, new_j, BoardState::WALL)) {
-                    robber_logic(new_i, new_j, robber_i, robber_j);
+                    commit_move(ROBBER_ID, make_pair(new_i, new_j));
                 } else {
                     cout << "Posição Inválida" << endl;
                 }
@@ -350,34 +395,6 @@ class Game {
         }
     }
 
-    void robber_logic(const int new_i, const int new_j, const int old_i, const int old_j) {
-        BoardState element = game_board.get_position(new_i, new_j);
-
-        switch (element) {
-            case BoardState::COP:
-                game_over();
-                break;
-            case BoardState::MONEY:
-                game_board.set_position(new_i, new_j, BoardState::ROBBER);
-                game_board.set_position(old_i, old_j, BoardState::EMPTY);
-                robber_position = make_pair(new_i, new_j);
-                money_num--;
-                cout << "Pegou Dinheiro" << endl;
-                break;
-            case BoardState::EMPTY:
-                game_board.set_position(new_i, new_j, BoardState::ROBBER);
-                game_board.set_position(old_i, old_j, BoardState::EMPTY);
-                robber_position = make_pair(new_i, new_j);
-                break;
-            default:
-                break;
-        }
-
-        if (money_num == 0) {
-            game_win();
-        }
-    }
-
     void game_over() {
         restore_input_mode();
         game_running = false;
@@ -411,7 +428,15 @@ class Game {
             generate_game_elements();
         }
 
+    void subscribe(EventHandler handler) { //inscreve um handler para receber os eventos do jogo
+        lock_guard<mutex> lock(game_mutex);
+        event_subscribers.push_back(move(handler));
+    }
+
     void start_game() {
+        // O próprio jogo é o último inscrito, já que game_over e game_win encerram o programa
+        subscribe([this](GameEvent event, const pair<int, int>& position) { handle_game_event(event, position); });
+
         // Iniciar renderização do thread
         render_thread = thread(&Game::render_game_board, this);
 